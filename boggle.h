@@ -0,0 +1,238 @@
+// 2015 - Lee Chu
+//
+// The boggle solver as a library, for programs that want to solve boards
+// without going through the command line tool.  Build boggle.C with
+// BOGGLE_NO_MAIN defined and link it in.
+//
+// A dictionary is loaded once and never changes afterwards, so it can
+// be shared by any number of solvers, including solvers that are running
+// on different threads.  A solver is not thread safe itself; give each
+// thread its own.
+//
+// Nothing is printed while solving.  Loading a dictionary still reports
+// its progress (and any errors) on stdout, the same as the command line
+// tool does.
+//
+
+#ifndef BOGGLE_H
+#define BOGGLE_H
+
+#include <stdint.h>
+
+struct BoggleDictionary;
+struct BoggleSolver;
+struct BoggleTracer;
+
+// A game board of rows*cols letters (in UTF-8, in either case), laid out
+// one row after another.  For a board with multi-letter tiles ("Qu",
+// "Th"), 'tiles' can be set instead, to one string of 1 to 3 letters per
+// tile, and 'letters' is then ignored.  The letters are only looked at
+// while the board is being solved.  A board is read in the dictionary's
+// alphabet (see boggleDictionaryLoad()).
+//
+struct BoggleBoard
+{
+  int rows;
+  int cols;
+  const char *letters;
+  const char *const *tiles;
+};
+
+// What a solve hands back.  BOGGLE_QUERY_WORDS lists every word found.
+// BOGGLE_QUERY_SCORE lists nothing, and only adds up the words' scores.
+// BOGGLE_QUERY_TOP lists just the 'topK' highest scoring words, best
+// first (longer words first among words that score the same, then
+// alphabetically).  The total score is kept in every mode.
+//
+enum BoggleQuery
+{
+  BOGGLE_QUERY_WORDS,
+  BOGGLE_QUERY_SCORE,
+  BOGGLE_QUERY_TOP
+};
+
+// How a solver goes about its work.  boggleSolverDefaults() fills in the
+// same defaults the command line tool uses.
+//
+struct BoggleSolverOptions
+{
+  // Worker threads used per board, and how deep into a search they may
+  // share out work (see --steal-depth)
+  //
+  int numThreads;
+  int stealDepth;
+
+  // Report a word for every path that spells it rather than only once
+  //
+  bool allPaths;
+
+  // Stop searching parts of the dictionary in which every word has
+  // already been found (see --prune)
+  //
+  bool pruneFound;
+
+  // See BoggleQuery.  Each word is only counted once in the score and
+  // top modes, so allPaths is ignored by them.
+  //
+  BoggleQuery query;
+  int topK;
+
+  // Keep every word found, and the tiles of a path that spells it, so
+  // that boggleSolveChange() can re-solve the board after one of its
+  // tiles changes.  Each word is then reported once, so allPaths is
+  // ignored.
+  //
+  bool incremental;
+
+  // Stop a solve once it has run for timeLimit seconds, or moved to
+  // nodeLimit tiles, and keep the words found by then (see
+  // boggleSolverComplete()).  Zero means no limit.  Limits are the same
+  // whatever the number of threads, and don't apply to incremental
+  // solvers, which need every word of a board to re-solve it.
+  //
+  double timeLimit;
+  uint64_t nodeLimit;
+};
+
+// One word found on the board, in lowercase UTF-8.  'path' holds the
+// board index (row*cols + col) of each of the word's 'length' tiles, in
+// order (with multi-letter tiles, the word has more letters than that).
+// Both point into the solver and stay valid until its next solve.
+//
+struct BoggleWord
+{
+  const char *word;
+  const int *path;
+  int length;
+};
+
+// Load a plain word list (unfiltered) or dictionary image.  With
+// buildDawg set, a word list is minimized into a DAWG.  Returns NULL on
+// failure.  Word lists are UTF-8; the dictionary's alphabet is made up of
+// the letters its words use, up to 30 of them.
+//
+BoggleDictionary *boggleDictionaryLoad( const char *path,
+                                        bool buildDawg );
+void boggleDictionaryFree( BoggleDictionary *dict );
+uint32_t boggleDictionaryNumWords( const BoggleDictionary *dict );
+
+void boggleSolverDefaults( BoggleSolverOptions *options );
+
+// The dictionary must outlive the solver.  Returns NULL on failure.
+//
+BoggleSolver *boggleSolverCreate( const BoggleDictionary *dict,
+                                  const BoggleSolverOptions *options );
+void boggleSolverFree( BoggleSolver *solver );
+
+// Find every word on the board.  Returns false if the board isn't valid
+// or memory ran out.  The words found are then available from
+// boggleSolverWords(), in the same order the command line tool prints
+// them.
+//
+bool boggleSolve( BoggleSolver *solver,
+                  const BoggleBoard *board );
+int boggleSolverNumWords( const BoggleSolver *solver );
+const BoggleWord *boggleSolverWords( const BoggleSolver *solver );
+
+// The total score of every word found on the last board, under the
+// official scoring (3 and 4 letter words score 1, 5 letters 2, 6 letters
+// 3, 7 letters 5, and 8 or more letters 11), and how many words that was.
+//
+uint32_t boggleSolverScore( const BoggleSolver *solver );
+uint32_t boggleSolverNumFound( const BoggleSolver *solver );
+
+// False if the last solve ran out of its time or node limit before
+// finishing, in which case its words, score and count only cover the part
+// of the board that was searched.
+//
+bool boggleSolverComplete( const BoggleSolver *solver );
+
+// Scoring a great many boards at once, for offline analysis of board
+// generators and the like.  The dictionary is only read, and the boards
+// are shared out between 'numThreads' threads (the calling thread being
+// one of them), each solving whole boards one after another.  Every
+// board goes through boggleSolve() with BOGGLE_QUERY_SCORE, so it is
+// read and checked the same way, and its score and count come out the
+// same.
+//
+// scores[i] is filled in for boards[i]; 'valid' is false (and the score
+// and count zero) for a board that boggleSolve() would turn down.  If
+// 'wordSets' isn't NULL, it has room for boggleDictionaryWordSetSize()
+// words per board, one after another, and bit n of board i's words
+// (wordSets[i*size + n/64] >> n%64) is set if the board has the word at
+// position n of the dictionary (see boggleDictionaryWord()).  Returns how
+// many boards were valid, or -1 if threads or memory ran out.
+//
+struct BoggleBoardScore
+{
+  uint32_t score;
+  uint32_t numFound;
+  bool valid;
+};
+
+int boggleScoreBoards( const BoggleDictionary *dict,
+                       const BoggleBoard *boards,
+                       int numBoards,
+                       int numThreads,
+                       BoggleBoardScore *scores,
+                       uint64_t *wordSets );
+uint32_t boggleDictionaryWordSetSize( const BoggleDictionary *dict );
+
+// The word at 'position' (0 to boggleDictionaryNumWords()-1) in the
+// dictionary, in lowercase UTF-8, zero terminated in 'word', which has
+// room for 'size' bytes.  Words are in the order of the alphabet's
+// letters, which is a-z followed by any others when the words use every
+// one of a-z (see boggleDictionaryLoad()).  Returns the word's length
+// in bytes, or -1 if there's no such word or no room for it.
+//
+int boggleDictionaryWord( const BoggleDictionary *dict,
+                          uint32_t position,
+                          char *word,
+                          int size );
+
+// Change the tile at board index 'index' of the last board solved to
+// 'tile' (1 to 3 letters, like a BoggleBoard tile) and solve it again,
+// for a solver created with 'incremental' set.  Only the words whose
+// path went through that tile are traced again, and only paths through
+// it are searched for new words, which is far less work than solving the
+// whole board.  The words, score and count come out the same as
+// boggleSolve() would give for the changed board, though the words may
+// be listed in another order, and with other paths.  This is always done
+// on the calling thread.
+//
+// Returns false without changing anything if there is no board or the
+// tile isn't valid.  If memory runs out, it returns false and there is
+// no board to change until the next boggleSolve().
+//
+bool boggleSolveChange( BoggleSolver *solver,
+                        int index,
+                        const char *tile );
+
+// Checking the words that players submit doesn't need a dictionary, or a
+// search of the whole board.  A tracer holds one prepared board, and
+// looks for a path that spells each word it's given, following only the
+// tiles that carry the word's next letter.  Like a solver, a tracer is
+// not thread safe.
+//
+BoggleTracer *boggleTracerCreate();
+void boggleTracerFree( BoggleTracer *tracer );
+
+// Returns false if the board isn't valid or memory ran out, in which
+// case the tracer has no board until the next one is set.
+//
+bool boggleTracerSetBoard( BoggleTracer *tracer,
+                           const BoggleBoard *board );
+
+// Trace each of 'numWords' words (UTF-8) on the board.  found[i] is
+// filled in for words[i]: 'word' points to it, and if it can be spelled,
+// 'path' and 'length' are one path that spells it (otherwise NULL and
+// 0).  The paths point into the tracer and stay valid until its next
+// trace or board.  Returns how many of the words could be spelled, or
+// -1 if there is no board or memory ran out.
+//
+int boggleTracerTrace( BoggleTracer *tracer,
+                       const char *const *words,
+                       int numWords,
+                       BoggleWord *found );
+
+#endif